@@ -1,9 +1,35 @@
 #include "board.h"
 
-bool Board::At(const int x, const int y) const { return board_[x][y]; }
+bool Board::At(const int x, const int y) const { return (rows_[y] >> x) & 1; }
 
 void Board::Set(const int x, const int y, const bool value) {
-  board_[x][y] = value;
+  const uint16_t mask{static_cast<uint16_t>(1U << x)};
+  if (value) {
+    rows_[y] |= mask;
+  } else {
+    rows_[y] &= ~mask;
+  }
+}
+
+uint16_t Board::Row(const int y) const { return rows_[y]; }
+
+bool Board::InsertGarbage(const int lines, const int hole) {
+  const int count{lines < Board::Height() ? lines : Board::Height()};
+  const uint16_t garbage{static_cast<uint16_t>(kFullRow & ~(1U << hole))};
+
+  bool overflow{false};
+  for (int y{0}; y < count; ++y) {
+    if (rows_[y] != 0) overflow = true;
+  }
+
+  for (int y{0}; y < Board::Height() - count; ++y) {
+    rows_[y] = rows_[y + count];
+  }
+  for (int y{Board::Height() - count}; y < Board::Height(); ++y) {
+    rows_[y] = garbage;
+  }
+
+  return overflow;
 }
 
 int Board::ClearLines() {
@@ -11,17 +37,10 @@ int Board::ClearLines() {
 
   int y{Board::Height() - 1};
   while (y >= 0) {
-    int quantity{0};
-    for (int x{0}; x < Board::Width(); ++x) {
-      if (At(x, y)) ++quantity;
-    }
-
-    if (quantity == 0) {
+    if (rows_[y] == 0) {
       break;
-    } else if (quantity == Board::Width()) {
-      for (int x{0}; x < Board::Width(); ++x) {
-        Set(x, y, false);
-      }
+    } else if (rows_[y] == kFullRow) {
+      rows_[y] = 0;
 
       MoveLines(y);
       ++cleared_lines;
@@ -34,17 +53,13 @@ int Board::ClearLines() {
 }
 
 void Board::Clear() {
-  for (int x{0}; x < Board::Width(); ++x) {
-    for (int y{0}; y < Board::Height(); ++y) {
-      Set(x, y, false);
-    }
+  for (int y{0}; y < Board::Height(); ++y) {
+    rows_[y] = 0;
   }
 }
 
 void Board::MoveLines(const int max_y) {
   for (int y{max_y}; y > 0; --y) {
-    for (int x{0}; x < Board::Width(); ++x) {
-      Set(x, y, At(x, y - 1));
-    }
+    rows_[y] = rows_[y - 1];
   }
 }
@@ -1,8 +1,12 @@
 #ifndef TETRIS_BOARD_H_
 #define TETRIS_BOARD_H_
 
+#include <stdint.h>
+
 /**
  * The Board class is used to store and manage the state of the game board.
+ * Every row is packed into a single bit mask, so the whole board takes only a
+ * few dozen bytes and can be copied like plain data.
  */
 class Board {
  public:
@@ -22,6 +26,24 @@ class Board {
    * @param value The new value at specified position
    */
   void Set(const int x, const int y, const bool value);
+  /**
+   * @param y The y-coordinate of the row
+   *
+   * @returns The row at the specified position as a bit mask, where bit x is
+   * set if the block at x is filled.
+   */
+  uint16_t Row(const int y) const;
+  /**
+   * Pushes the board up and fills the bottom lines with garbage blocks,
+   * leaving a single hole in each of them. Lines pushed above the top of the
+   * board are discarded.
+   *
+   * @param lines The number of garbage lines to insert
+   * @param hole The x-coordinate of the empty block in every garbage line
+   *
+   * @returns True if any discarded line had blocks on it, false otherwise.
+   */
+  bool InsertGarbage(const int lines, const int hole);
   /**
    * Checks for full lines on the board and clears them, moving any lines above
    * them down if necessary.
@@ -46,6 +68,9 @@ class Board {
   static constexpr int kHeight{20};
   static constexpr int kBlockWidth{8};
   static constexpr int kBlockHeight{5};
+  static constexpr uint16_t kFullRow{(1UL << kWidth) - 1};
+
+  static_assert(kWidth <= 16, "A board row must fit in a 16-bit mask");
 
   /**
    * Moves all the lines with y lower than the provided value down by one
@@ -56,7 +81,7 @@ class Board {
    */
   void MoveLines(const int max_y);
 
-  bool board_[kWidth][kHeight];
+  uint16_t rows_[kHeight];
 };
 
 #endif  // TETRIS_BOARD_H_
\ No newline at end of file
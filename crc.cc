@@ -0,0 +1,9 @@
+#include "crc.h"
+
+uint8_t UpdateCrc8(uint8_t crc, const uint8_t value) {
+  crc ^= value;
+  for (int i{0}; i < 8; ++i) {
+    crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+  }
+  return crc;
+}
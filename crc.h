@@ -0,0 +1,16 @@
+#ifndef TETRIS_CRC_H_
+#define TETRIS_CRC_H_
+
+#include <stdint.h>
+
+/**
+ * Updates a CRC-8 checksum (polynomial 0x07) with one more byte.
+ *
+ * @param crc The checksum of the preceding bytes, 0 for the first byte
+ * @param value The next byte
+ *
+ * @returns The updated checksum.
+ */
+uint8_t UpdateCrc8(uint8_t crc, const uint8_t value);
+
+#endif  // TETRIS_CRC_H_
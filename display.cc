@@ -22,6 +22,13 @@ void Display::PrintScore(const int score) {
   display_.print(min(score, 999));
 }
 
+void Display::PrintOpponent(const int height) {
+  display_.setCursor(13, 1);
+  display_.print("^");
+  if (height < 10) display_.print(" ");
+  display_.print(height);
+}
+
 void Display::Intro() {
   uint8_t block_character[] = {0b11111, 0b11111, 0b11111, 0b11111,
                                0b11111, 0b11111, 0b11111, 0b11111};
@@ -42,6 +42,12 @@ class Display {
    * @param score The new score to display
    */
   void PrintScore(const int score);
+  /**
+   * Updates the height of the other game's stack in versus mode.
+   *
+   * @param height The height of the highest column on the other board
+   */
+  void PrintOpponent(const int height);
 
   /**
    * Displays an introductory message that includes the game title and author.
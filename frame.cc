@@ -0,0 +1,46 @@
+#include "frame.h"
+
+#include "crc.h"
+
+int EncodeFrame(uint8_t* const frame, const FrameType type,
+                const uint8_t sequence, const uint8_t* const payload,
+                const int size) {
+  int length{0};
+  frame[length++] = kFrameSync;
+  frame[length++] = static_cast<uint8_t>(type);
+  frame[length++] = sequence;
+  frame[length++] = size;
+  for (int i{0}; i < size; ++i) {
+    frame[length++] = payload[i];
+  }
+
+  uint8_t crc{0};
+  for (int i{1}; i < length; ++i) {
+    crc = UpdateCrc8(crc, frame[i]);
+  }
+  frame[length++] = crc;
+  return length;
+}
+
+bool FrameReader::Feed(const uint8_t value) {
+  if (size_ == 0 && value != kFrameSync) return false;
+
+  buffer_[size_++] = value;
+  if (size_ < kFrameHeaderSize) return false;
+
+  const int payload_size{buffer_[3]};
+  if (payload_size > kFrameMaxPayloadSize) {
+    size_ = 0;
+    return false;
+  }
+  if (size_ < kFrameHeaderSize + payload_size + 1) return false;
+
+  const int crc_index{size_ - 1};
+  size_ = 0;
+
+  uint8_t crc{0};
+  for (int i{1}; i < crc_index; ++i) {
+    crc = UpdateCrc8(crc, buffer_[i]);
+  }
+  return crc == buffer_[crc_index];
+}
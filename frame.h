@@ -0,0 +1,71 @@
+#ifndef TETRIS_FRAME_H_
+#define TETRIS_FRAME_H_
+
+#include <stdint.h>
+
+/**
+ * Every frame sent over the serial link has the following layout:
+ *
+ *   sync (0x7E) | type | sequence | payload size | payload | CRC-8
+ *
+ * The checksum covers all bytes between the sync byte and the checksum.
+ */
+constexpr uint8_t kFrameSync{0x7E};
+constexpr int kFrameHeaderSize{4};
+constexpr int kFrameMaxPayloadSize{96};
+constexpr int kFrameMaxSize{kFrameHeaderSize + kFrameMaxPayloadSize + 1};
+
+/**
+ * The FrameType enum identifies the content of the frame payload, so several
+ * features can share a single serial link.
+ */
+enum class FrameType : uint8_t {
+  kVersus = 1,
+  kTelemetry = 2,
+};
+
+/**
+ * Builds a complete frame in the output buffer.
+ *
+ * @param frame The buffer for at least `kFrameMaxSize` bytes
+ * @param type The type of the frame
+ * @param sequence The sequence number of the frame
+ * @param payload The payload bytes
+ * @param size The number of payload bytes, up to `kFrameMaxPayloadSize`
+ *
+ * @returns The number of bytes written to the buffer.
+ */
+int EncodeFrame(uint8_t* const frame, const FrameType type,
+                const uint8_t sequence, const uint8_t* const payload,
+                const int size);
+
+/**
+ * The FrameReader class assembles frames from the received bytes. Bytes
+ * outside of a frame and frames with an invalid checksum are dropped.
+ */
+class FrameReader {
+ public:
+  /**
+   * Processes the next received byte.
+   *
+   * @param value The received byte
+   *
+   * @returns True if the byte completed a valid frame, false otherwise.
+   */
+  bool Feed(const uint8_t value);
+
+  /**
+   * The accessors below describe the last completed frame and stay valid
+   * until the next call to `Feed`.
+   */
+  FrameType Type() const { return static_cast<FrameType>(buffer_[1]); }
+  uint8_t Sequence() const { return buffer_[2]; }
+  int PayloadSize() const { return buffer_[3]; }
+  const uint8_t* Payload() const { return buffer_ + kFrameHeaderSize; }
+
+ private:
+  uint8_t buffer_[kFrameMaxSize];
+  int size_{0};
+};
+
+#endif  // TETRIS_FRAME_H_
@@ -1,9 +1,6 @@
 #include "game.h"
 
-Game::~Game() {
-  delete display_;
-  delete tetromino_;
-}
+Game::~Game() { delete display_; }
 
 void Game::Setup() {
   pinMode(kLeftButtonPin, INPUT_PULLUP);
@@ -11,6 +8,13 @@ void Game::Setup() {
   pinMode(kRotateButtonPin, INPUT_PULLUP);
   pinMode(kRapidFallButtonPin, INPUT_PULLUP);
 
+  Serial.begin(kSerialBaudRate);
+  serial_idle_space_ = Serial.availableForWrite();
+
+  constexpr int kButtonPins[]{kLeftButtonPin, kRightButtonPin,
+                              kRotateButtonPin, kRapidFallButtonPin};
+  scheduler_.Setup(kButtonPins, sizeof(kButtonPins) / sizeof(kButtonPins[0]),
+                   Serial);
   randomSeed(analogRead(0));
 
   if (!EEPROM.read(kMemoryHighScoreAddress)) {
@@ -26,26 +30,163 @@ void Game::Setup() {
 void Game::Update() {
   bool changes{false};
 
-  if (!tetromino_) {
-    tetromino_ = new Tetromino();
+  if (versus_ && link_.Poll()) {
+    display_->PrintOpponent(link_.OpponentHeight());
+  }
+
+  const unsigned long time{millis()};
+  if (HandleUndo(time)) return;
+
+  if (!state_.has_tetromino) {
+    state_.tetromino = Tetromino(NextRandom() % kFiguresSize);
+    state_.has_tetromino = true;
     changes = true;
 
-    if (tetromino_->Collide(board_)) return GameOver();
+    if (state_.tetromino.Collide(state_.board)) return GameOver();
+    history_.Push(state_);
+    tetromino_moved_ = false;
   }
 
-  const unsigned long time{millis()};
   if (HandleRapidFall()) return;
   if (HandleUserInput(time)) changes = true;
   if (HandleTetrominoMoveDown(time)) changes = true;
 
-  if (changes) display_->DrawBoard(board_, tetromino_);
+  if (changes) display_->DrawBoard(state_.board, CurrentTetromino());
+}
+
+void Game::Report() {
+  if (kTelemetryEnabled && !versus_) {
+    telemetry_.Record(state_.board, CurrentTetromino(), state_.score,
+                      ReadButtons());
+  }
+  transmitter_.Flush();
+}
+
+void Game::Sleep() { scheduler_.Sleep(TimeToNextTick(), SleepMode()); }
+
+GameState Game::Snapshot() const { return state_; }
+
+void Game::Restore(const GameState& state) {
+  state_ = state;
+
+  display_->Start();
+  display_->PrintScore(state_.score);
+  display_->DrawBoard(state_.board, CurrentTetromino());
+  if (versus_) {
+    display_->PrintOpponent(link_.OpponentHeight());
+    link_.QueueSummary(state_.board);
+  }
+}
+
+bool Game::Undo() {
+  if (versus_) return false;
+
+  // The newest snapshot is the spawn of the current tetromino, so if it has
+  // not moved yet the one before it is restored. The restored snapshot stays
+  // in the history as the spawn of the restored tetromino.
+  GameState state;
+  if (!history_.Pop(state)) return false;
+  if (!tetromino_moved_ && !history_.Pop(state)) {
+    history_.Push(state);
+    return false;
+  }
+  history_.Push(state);
+  tetromino_moved_ = false;
+
+  state.last_action_time = millis();
+  state.last_move_time = millis();
+  Restore(state);
+
+  SaveGameState(kMemorySavedGameAddress, state_);
+  landings_since_save_ = 0;
+  return true;
+}
+
+bool Game::Transmitting() const {
+  return transmitter_.Pending() ||
+         Serial.availableForWrite() < serial_idle_space_;
+}
+
+Scheduler::Mode Game::SleepMode() const {
+  if (versus_) return Scheduler::Mode::kListen;
+  if (Transmitting()) return Scheduler::Mode::kIdle;
+
+  // Powering down stops the serial port, so the byte still being shifted out
+  // is finished first. With an empty buffer it takes well below a millisecond.
+  Serial.flush();
+  return Scheduler::Mode::kDeep;
+}
+
+Scheduler::Statistics Game::SchedulerStats() const {
+  return scheduler_.Stats();
+}
+
+unsigned long Game::TimeToNextTick() const {
+  if (!state_.has_tetromino) return 0;
+
+  const unsigned long time{millis()};
+  const unsigned long last_move_delta{time - state_.last_move_time};
+  if (last_move_delta >= kMoveTimeDelay) return 0;
+  unsigned long wait{kMoveTimeDelay - last_move_delta};
+  if (link_.Pending() || Transmitting()) {
+    wait = min(wait, kInputPollDelay);
+  }
+
+  if (digitalRead(kLeftButtonPin) == LOW ||
+      digitalRead(kRightButtonPin) == LOW ||
+      digitalRead(kRotateButtonPin) == LOW) {
+    const unsigned long last_action_delta{time - state_.last_action_time};
+    const unsigned long action_wait{last_action_delta >= kActionTimeDelay
+                                        ? kInputPollDelay
+                                        : kActionTimeDelay - last_action_delta};
+    wait = min(wait, action_wait);
+  }
+
+  return wait;
+}
+
+uint8_t Game::ReadButtons() const {
+  uint8_t buttons{0};
+  if (digitalRead(kLeftButtonPin) == LOW) buttons |= kTelemetryLeftButton;
+  if (digitalRead(kRightButtonPin) == LOW) buttons |= kTelemetryRightButton;
+  if (digitalRead(kRotateButtonPin) == LOW) buttons |= kTelemetryRotateButton;
+  if (digitalRead(kRapidFallButtonPin) == LOW) {
+    buttons |= kTelemetryRapidFallButton;
+  }
+  return buttons;
+}
+
+const Tetromino* Game::CurrentTetromino() const {
+  return state_.has_tetromino ? &state_.tetromino : nullptr;
+}
+
+uint32_t Game::NextRandom() {
+  // xorshift32, kept in the game state so snapshots replay the same figures
+  uint32_t& x{state_.random_state};
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x;
+}
+
+bool Game::HandleUndo(const unsigned long time) {
+  const unsigned long last_action_delta{time - state_.last_action_time};
+
+  if (last_action_delta >= kActionTimeDelay &&
+      digitalRead(kLeftButtonPin) == LOW &&
+      digitalRead(kRightButtonPin) == LOW) {
+    if (!Undo()) state_.last_action_time = time;
+    return true;
+  }
+
+  return false;
 }
 
 bool Game::HandleRapidFall() {
   if (digitalRead(kRapidFallButtonPin) == LOW) {
-    while (!tetromino_->MoveDown(board_)) {
-      display_->DrawBoard(board_, tetromino_);
-      delay(kRapidFallLineDelay);
+    while (!state_.tetromino.MoveDown(state_.board)) {
+      display_->DrawBoard(state_.board, CurrentTetromino());
+      scheduler_.Delay(kRapidFallLineDelay, SleepMode());
     }
 
     RemoveTetromino();
@@ -56,21 +197,23 @@ bool Game::HandleRapidFall() {
 }
 
 bool Game::HandleUserInput(const unsigned long time) {
-  const unsigned long last_action_delta{time - last_action_time_};
+  const unsigned long last_action_delta{time - state_.last_action_time};
 
   if (last_action_delta >= kActionTimeDelay) {
     bool action{false};
 
     if (digitalRead(kLeftButtonPin) == LOW) {
-      action = tetromino_->Move(board_, Tetromino::Direction::kLeft);
+      action = state_.tetromino.Move(state_.board, Tetromino::Direction::kLeft);
     } else if (digitalRead(kRightButtonPin) == LOW) {
-      action = tetromino_->Move(board_, Tetromino::Direction::kRight);
+      action =
+          state_.tetromino.Move(state_.board, Tetromino::Direction::kRight);
     } else if (digitalRead(kRotateButtonPin) == LOW) {
-      action = tetromino_->Rotate(board_);
+      action = state_.tetromino.Rotate(state_.board);
     }
 
     if (action) {
-      last_action_time_ = time;
+      state_.last_action_time = time;
+      tetromino_moved_ = true;
       return true;
     }
   }
@@ -79,11 +222,11 @@ bool Game::HandleUserInput(const unsigned long time) {
 }
 
 bool Game::HandleTetrominoMoveDown(const unsigned long time) {
-  const unsigned long last_move_delta{time - last_move_time_};
+  const unsigned long last_move_delta{time - state_.last_move_time};
 
   if (last_move_delta >= kMoveTimeDelay) {
-    if (tetromino_->MoveDown(board_)) RemoveTetromino();
-    last_move_time_ = time;
+    state_.last_move_time = time;
+    if (state_.tetromino.MoveDown(state_.board)) RemoveTetromino();
     return true;
   }
 
@@ -91,43 +234,101 @@ bool Game::HandleTetrominoMoveDown(const unsigned long time) {
 }
 
 void Game::RemoveTetromino() {
-  tetromino_->Draw(board_, true);
-  delete tetromino_;
-  tetromino_ = nullptr;
+  state_.tetromino.Draw(state_.board, true);
+  state_.has_tetromino = false;
+  tetromino_moved_ = true;
+
+  ++state_.score;
+  const int cleared_lines{state_.board.ClearLines()};
+  state_.score += cleared_lines * kClearedLineScoreBonus;
+
+  if (versus_) {
+    constexpr int kMaxClearedLines{sizeof(kGarbageLines) /
+                                       sizeof(kGarbageLines[0]) - 1};
+    link_.QueueGarbage(kGarbageLines[min(cleared_lines, kMaxClearedLines)]);
+
+    const int garbage_lines{link_.TakeGarbage()};
+    if (garbage_lines > 0 &&
+        state_.board.InsertGarbage(garbage_lines,
+                                   NextRandom() % Board::Width())) {
+      return GameOver();
+    }
+    link_.QueueSummary(state_.board);
+  }
 
-  ++score_;
-  score_ += board_.ClearLines() * kClearedLineScoreBonus;
+  display_->PrintScore(state_.score);
 
-  display_->PrintScore(score_);
+  if (!versus_ && ++landings_since_save_ >= kSaveLandingInterval) {
+    SaveGameState(kMemorySavedGameAddress, state_);
+    landings_since_save_ = 0;
+  }
 }
 
 void Game::Intro() {
   display_->Intro();
-  delay(kIntroDelay);
-  Start();
+  scheduler_.Delay(kIntroDelay, SleepMode());
+  versus_ = digitalRead(kRotateButtonPin) == LOW;
+  if (versus_ || !Resume()) Start();
 }
 
 void Game::Start() {
-  delete tetromino_;
-  tetromino_ = nullptr;
+  state_.has_tetromino = false;
 
-  score_ = 0;
-  last_action_time_ = millis();
-  last_move_time_ = millis();
+  state_.score = 0;
+  state_.last_action_time = millis();
+  state_.last_move_time = millis();
+  state_.random_state = random(1, 0x7FFFFFFF);
 
-  board_.Clear();
+  state_.board.Clear();
+  history_.Clear();
+  landings_since_save_ = 0;
   display_->Start();
+  if (versus_) {
+    link_.DiscardGarbage();
+    link_.QueueSummary(state_.board);
+    display_->PrintOpponent(link_.OpponentHeight());
+  }
+}
+
+bool Game::Resume() {
+  GameState state;
+  if (!LoadGameState(kMemorySavedGameAddress, state)) return false;
+
+  state.last_action_time = millis();
+  state.last_move_time = millis();
+  history_.Clear();
+  Restore(state);
+  return true;
 }
 
 void Game::GameOver() {
   const int high_score{EEPROM.read(0)};
 
-  display_->GameOver(score_, high_score);
-  if (score_ > high_score) EEPROM.update(0, score_);
-  delay(kGameOverDelay);
+  if (!versus_) EraseGameState(kMemorySavedGameAddress);
+  display_->GameOver(state_.score, high_score);
+  if (state_.score > high_score) EEPROM.update(0, state_.score);
+  Wait(kGameOverDelay);
 
   display_->Restart();
   while (digitalRead(kRotateButtonPin) == HIGH) {
+    if (versus_) link_.Poll();
+    transmitter_.Flush();
+    scheduler_.Sleep(Transmitting() ? kInputPollDelay : kGameOverDelay,
+                     SleepMode());
   }
   Start();
 }
+
+void Game::Wait(const unsigned long duration) {
+  const unsigned long start{millis()};
+
+  for (unsigned long elapsed{0}; elapsed < duration;
+       elapsed = millis() - start) {
+    // The queued bytes are sent in short steps, so the MCU can power down
+    // as soon as they are gone
+    transmitter_.Flush();
+    const unsigned long wait{duration - elapsed};
+    scheduler_.Delay(Transmitting() ? min(wait, kInputPollDelay) : wait,
+                     SleepMode());
+  }
+}
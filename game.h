@@ -5,7 +5,12 @@
 
 #include "board.h"
 #include "display.h"
+#include "game_state.h"
+#include "link.h"
+#include "scheduler.h"
+#include "telemetry.h"
 #include "tetromino.h"
+#include "transmit_buffer.h"
 
 /* Settings */
 constexpr unsigned long kIntroDelay{1000};          // default: 1000
@@ -13,7 +18,12 @@ constexpr unsigned long kGameOverDelay{3000};       // default: 3000
 constexpr unsigned long kActionTimeDelay{150};      // default: 150
 constexpr unsigned long kMoveTimeDelay{350};        // default: 350
 constexpr unsigned long kRapidFallLineDelay{20};    // default: 20
+constexpr unsigned long kInputPollDelay{10};        // default: 10
+constexpr unsigned long kSerialBaudRate{115200};    // default: 115200
+constexpr int kGarbageLines[]{0, 0, 1, 2, 4};       // default: {0, 0, 1, 2, 4}
+constexpr bool kTelemetryEnabled{true};             // default: true
 constexpr unsigned long kClearedLineScoreBonus{5};  // default: 5
+constexpr int kSaveLandingInterval{10};             // default: 10
 
 /* Pins */
 constexpr int kLeftButtonPin{4};
@@ -34,7 +44,7 @@ constexpr int kLcdD7Pin{13};
 class Game {
  public:
   /**
-   * Deallocates the memory used by the display and tetromino objects.
+   * Deallocates the memory used by the display object.
    */
   ~Game();
 
@@ -50,10 +60,94 @@ class Game {
    * and handling user input.
    */
   void Update();
+  /**
+   * Records the telemetry of the current game state and passes the queued
+   * frames to the serial port. The telemetry is not sent in versus mode,
+   * which uses the same port.
+   */
+  void Report();
+  /**
+   * Puts the MCU to sleep until the next game tick is due, any button changes
+   * its state or, in versus mode, the serial port receives data.
+   */
+  void Sleep();
+
+  /**
+   * @returns A copy of the current game state.
+   */
+  GameState Snapshot() const;
+  /**
+   * Replaces the current game state with the specified one and redraws the
+   * display.
+   *
+   * @param state The state to restore
+   */
+  void Restore(const GameState& state);
+  /**
+   * Restores the game state from when the current tetromino was spawned, or
+   * the previous one if the current one has not moved yet. Repeated calls walk
+   * back through the remembered tetrominoes. The restored state is saved to
+   * the EEPROM memory. Undo is disabled in versus mode, because the snapshots
+   * would remove received garbage lines.
+   *
+   * @returns True if the undo occured, false otherwise.
+   */
+  bool Undo();
+
+  /**
+   * @returns The wakeup and sleep time counters of the tick scheduler.
+   */
+  Scheduler::Statistics SchedulerStats() const;
 
  private:
   static constexpr int kMemoryHighScoreAddress{0};
+  static constexpr int kMemorySavedGameAddress{1};
 
+  /**
+   * Computes the time left until the next deadline, which is either the
+   * tetromino move down or, while any button is held, the input repeat.
+   *
+   * @returns The time to the next game tick in milliseconds.
+   */
+  unsigned long TimeToNextTick() const;
+  /**
+   * @returns The bit mask of the pressed buttons, as used by the telemetry.
+   */
+  uint8_t ReadButtons() const;
+  /**
+   * @returns True if any serial data is queued or still in the hardware
+   * transmit buffer.
+   */
+  bool Transmitting() const;
+  /**
+   * Chooses the deepest sleep mode that keeps the serial port working. In
+   * versus mode the port has to keep receiving, otherwise the MCU idles while
+   * the hardware transmit buffer drains and is powered down once it is empty.
+   *
+   * @returns The sleep mode for the scheduler.
+   */
+  Scheduler::Mode SleepMode() const;
+  /**
+   * @returns The current tetromino, or nullptr if there is none.
+   */
+  const Tetromino* CurrentTetromino() const;
+  /**
+   * Advances the random generator stored in the game state.
+   *
+   * @returns The next random number.
+   */
+  uint32_t NextRandom();
+
+  /**
+   * Reverts to the previous tetromino if the user presses the "left" and
+   * "right" keys at the same time. The key combination is consumed even if
+   * there is nothing to undo.
+   *
+   * @param time The elapsed time in milliseconds
+   *
+   * @returns True if the key combination was pressed, false otherwise.
+   */
+  bool HandleUndo(const unsigned long time);
   /**
    * Handles a rapid tetromino fall if the user chooses to do so. If the user
    * presses the "drop" key, the method immediately moves the current tetromino
@@ -81,34 +175,61 @@ class Game {
    */
   bool HandleTetrominoMoveDown(const unsigned long time);
   /**
-   * Removes the current tetromino from the board and updates the score.
+   * Removes the current tetromino from the board, updates the score, exchanges
+   * garbage lines with the other game in versus mode and otherwise saves the
+   * game to the EEPROM memory every few landings. The game is over if the
+   * garbage lines push any blocks above the top of the board.
    */
   void RemoveTetromino();
 
   /**
    * Displays the game's intro sequence, which includes showing the game
-   * title and author. Once the intro is complete, the method starts the game.
+   * title and author. If the "rotate" key is held at the end of the intro,
+   * the game switches to versus mode, which always starts a new game and
+   * leaves the saved one alone. Otherwise the method resumes the saved game or
+   * starts a new one.
    */
   void Intro();
   /**
    * Resets the game state and starts the game. This includes resetting
-   * the score, deleting the tetromino, and clearing the game board.
+   * the score, removing the tetromino, clearing the game board, seeding
+   * the random generator and dropping any pending garbage lines.
    */
   void Start();
+  /**
+   * Loads the game saved in the EEPROM memory and continues it.
+   *
+   * @returns True if a saved game was resumed, false otherwise.
+   */
+  bool Resume();
   /**
    * Displays the "game over" message and waits for the player to restart the
    * game. If the player has achieved a new high score, the method saves it to
-   * the EEPROM memory.
+   * the EEPROM memory. The saved game in progress is erased, unless the game
+   * was played in versus mode. The serial data queued before the end of the
+   * game, like the final versus frame, is still sent while waiting.
    */
   void GameOver();
+  /**
+   * Sleeps for the whole specified time, ignoring the buttons, while sending
+   * the queued serial data.
+   *
+   * @param duration The wait time in milliseconds
+   */
+  void Wait(const unsigned long duration);
 
-  Board board_;
   Display* display_;
-  Tetromino* tetromino_;
+  Scheduler scheduler_;
+  TransmitBuffer transmitter_{Serial};
+  Link link_{Serial, transmitter_};
+  Telemetry telemetry_{transmitter_};
 
-  int score_{0};
-  unsigned long last_action_time_{0};
-  unsigned long last_move_time_{0};
+  GameState state_{};
+  GameStateHistory history_;
+  int landings_since_save_{0};
+  bool tetromino_moved_{false};
+  bool versus_{false};
+  int serial_idle_space_{0};
 };
 
 #endif  // TETRIS_GAME_H_
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "game_state.h"
+
+#include <EEPROM.h>
+
+#include "crc.h"
+
+namespace {
+
+constexpr uint8_t kSaveMagic{0x54};
+constexpr uint8_t kSaveVersion{1};
+
+static_assert(sizeof(GameState) <= 0xFF, "The state size must fit in a byte");
+
+}  // namespace
+
+void GameStateHistory::Push(const GameState& state) {
+  states_[head_] = state;
+  head_ = (head_ + 1) % kCapacity;
+  if (size_ < kCapacity) ++size_;
+}
+
+bool GameStateHistory::Pop(GameState& state) {
+  if (size_ == 0) return false;
+
+  head_ = (head_ + kCapacity - 1) % kCapacity;
+  --size_;
+  state = states_[head_];
+  return true;
+}
+
+void GameStateHistory::Clear() {
+  head_ = 0;
+  size_ = 0;
+}
+
+void SaveGameState(const int address, const GameState& state) {
+  // The timers are rebased on resume, so they would only wear the memory
+  GameState saved{state};
+  saved.last_action_time = 0;
+  saved.last_move_time = 0;
+  if (!saved.has_tetromino) saved.tetromino = Tetromino{};
+
+  const uint8_t* const bytes{reinterpret_cast<const uint8_t*>(&saved)};
+  uint8_t crc{0};
+
+  EEPROM.update(address, kSaveMagic);
+  EEPROM.update(address + 1, kSaveVersion);
+  EEPROM.update(address + 2, sizeof(GameState));
+  for (unsigned int i{0}; i < sizeof(GameState); ++i) {
+    EEPROM.update(address + 3 + i, bytes[i]);
+    crc = UpdateCrc8(crc, bytes[i]);
+  }
+  EEPROM.update(address + 3 + sizeof(GameState), crc);
+}
+
+bool LoadGameState(const int address, GameState& state) {
+  if (EEPROM.read(address) != kSaveMagic) return false;
+  if (EEPROM.read(address + 1) != kSaveVersion) return false;
+  if (EEPROM.read(address + 2) != sizeof(GameState)) return false;
+
+  GameState loaded;
+  uint8_t* const bytes{reinterpret_cast<uint8_t*>(&loaded)};
+  uint8_t crc{0};
+
+  for (unsigned int i{0}; i < sizeof(GameState); ++i) {
+    bytes[i] = EEPROM.read(address + 3 + i);
+    crc = UpdateCrc8(crc, bytes[i]);
+  }
+  if (EEPROM.read(address + 3 + sizeof(GameState)) != crc) return false;
+
+  state = loaded;
+  return true;
+}
+
+void EraseGameState(const int address) { EEPROM.update(address, 0); }
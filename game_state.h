@@ -0,0 +1,90 @@
+#ifndef TETRIS_GAME_STATE_H_
+#define TETRIS_GAME_STATE_H_
+
+#include <stdint.h>
+
+#include "board.h"
+#include "tetromino.h"
+
+/**
+ * The GameState struct holds everything needed to continue a game in
+ * progress: the board, the falling tetromino, the score, the timers and the
+ * state of the random generator. It is plain data, so it can be copied with a
+ * simple assignment or `memcpy`, e.g. for undo or look-ahead.
+ */
+struct GameState {
+  Board board;
+  Tetromino tetromino;
+  bool has_tetromino;
+  int score;
+  unsigned long last_action_time;
+  unsigned long last_move_time;
+  uint32_t random_state;
+};
+
+/**
+ * The GameStateHistory class is a small ring buffer of game state snapshots.
+ * Once it is full, pushing a new snapshot overwrites the oldest one.
+ */
+class GameStateHistory {
+ public:
+  /**
+   * Stores a copy of the specified state as the most recent snapshot.
+   *
+   * @param state The state to store
+   */
+  void Push(const GameState& state);
+  /**
+   * Removes the most recent snapshot and copies it to the specified state.
+   *
+   * @param state The state to overwrite with the snapshot
+   *
+   * @returns True if a snapshot was available, false otherwise.
+   */
+  bool Pop(GameState& state);
+  /**
+   * Removes all snapshots.
+   */
+  void Clear();
+
+ private:
+  static constexpr int kCapacity{4};
+
+  GameState states_[kCapacity];
+  int head_{0};
+  int size_{0};
+};
+
+/**
+ * Saves the game state to the EEPROM memory at the specified address. The
+ * format is a magic byte, a version byte, the payload size, the raw state
+ * bytes and a CRC-8 checksum. The timers and an absent tetromino are saved as
+ * zeros and only changed bytes are written, which limits the wear of the
+ * memory.
+ *
+ * @param address The EEPROM address of the first byte
+ * @param state The state to save
+ */
+void SaveGameState(const int address, const GameState& state);
+/**
+ * Loads the game state saved by `SaveGameState`.
+ *
+ * @param address The EEPROM address of the first byte
+ * @param state The state to overwrite with the saved one
+ *
+ * @returns True if a valid state was found, false otherwise.
+ */
+bool LoadGameState(const int address, GameState& state);
+/**
+ * Invalidates the game state saved at the specified address, so it will not
+ * be loaded again.
+ *
+ * @param address The EEPROM address of the first byte
+ */
+void EraseGameState(const int address);
+/**
+ * @returns The number of EEPROM bytes used by a saved game state.
+ */
+constexpr int GameStateSaveSize() { return sizeof(GameState) + 4; }
+
+#endif  // TETRIS_GAME_STATE_H_
@@ -0,0 +1,81 @@
+#ifndef TETRIS_HOST_ARDUINO_H_
+#define TETRIS_HOST_ARDUINO_H_
+
+// A minimal stand-in for the Arduino core, so the game can be built and run
+// on a Linux host. Only the parts used by the game are provided.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOW 0
+#define HIGH 1
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define CHANGE 1
+
+constexpr int kHostPins{20};
+
+template <typename T>
+T min(const T a, const T b) {
+  return b < a ? b : a;
+}
+template <typename T>
+T max(const T a, const T b) {
+  return a < b ? b : a;
+}
+
+unsigned long millis();
+void delay(const unsigned long duration);
+
+void pinMode(const int pin, const int mode);
+int digitalRead(const int pin);
+int analogRead(const int pin);
+int digitalPinToInterrupt(const int pin);
+void attachInterrupt(const int interrupt, void (*handler)(), const int mode);
+
+void randomSeed(const unsigned long seed);
+long random(const long max);
+long random(const long min, const long max);
+
+#include "Stream.h"
+#include "HardwareSerial.h"
+
+namespace host {
+
+/**
+ * Switches the clock to simulated time, which only advances in `delay` and
+ * `AdvanceClock`. It makes runs reproducible and independent of the host
+ * speed.
+ */
+void UseSimulatedClock();
+/**
+ * Moves the simulated clock forward without calling the idle handler. It
+ * stands in for the time the MCU spends on work.
+ *
+ * @param duration The time in milliseconds
+ */
+void AdvanceClock(const unsigned long duration);
+/**
+ * Holds the button on the specified pin down for the specified time. Pressing
+ * a released button triggers the interrupts attached to the pin.
+ *
+ * @param pin The button pin
+ * @param duration The time in milliseconds, 0 to release the button
+ */
+void PressButton(const int pin, const unsigned long duration);
+/**
+ * Sets the function called on every millisecond spent in `delay`, e.g. to
+ * read the keyboard while the game sleeps.
+ *
+ * @param handler The function to call, or nullptr
+ */
+void SetIdleHandler(void (*handler)());
+
+}  // namespace host
+
+#endif  // TETRIS_HOST_ARDUINO_H_
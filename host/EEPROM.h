@@ -0,0 +1,25 @@
+#ifndef TETRIS_HOST_EEPROM_H_
+#define TETRIS_HOST_EEPROM_H_
+
+#include "Arduino.h"
+
+/**
+ * The host EEPROM memory only lives as long as the process.
+ */
+class EEPROMClass {
+ public:
+  uint8_t read(const int address) const { return memory_[address]; }
+  void write(const int address, const uint8_t value) {
+    memory_[address] = value;
+  }
+  void update(const int address, const uint8_t value) {
+    if (memory_[address] != value) write(address, value);
+  }
+
+ private:
+  uint8_t memory_[1024]{};
+};
+
+extern EEPROMClass EEPROM;
+
+#endif  // TETRIS_HOST_EEPROM_H_
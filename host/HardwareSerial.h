@@ -0,0 +1,17 @@
+#ifndef TETRIS_HOST_HARDWARE_SERIAL_H_
+#define TETRIS_HOST_HARDWARE_SERIAL_H_
+
+#include "fd_stream.h"
+
+/**
+ * The host serial port is a stream over a file descriptor. It stays
+ * disconnected, dropping written bytes, until a descriptor is attached.
+ */
+class HardwareSerial : public FdStream {
+ public:
+  void begin(const unsigned long baud_rate) { (void)baud_rate; }
+};
+
+extern HardwareSerial Serial;
+
+#endif  // TETRIS_HOST_HARDWARE_SERIAL_H_
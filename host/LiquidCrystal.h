@@ -0,0 +1,74 @@
+#ifndef TETRIS_HOST_LIQUID_CRYSTAL_H_
+#define TETRIS_HOST_LIQUID_CRYSTAL_H_
+
+#include <stdio.h>
+
+#include "Arduino.h"
+
+/**
+ * The host LCD keeps the printed text, so it can be shown in a terminal.
+ * Custom characters are shown as '#'.
+ */
+class LiquidCrystal {
+ public:
+  LiquidCrystal(int rs, int enable, int d4, int d5, int d6, int d7) {
+    (void)rs, (void)enable, (void)d4, (void)d5, (void)d6, (void)d7;
+    clear();
+    instance_ = this;
+  }
+
+  /**
+   * @returns The most recently created LCD, or nullptr if there is none.
+   */
+  static const LiquidCrystal* Instance() { return instance_; }
+
+  void begin(const int columns, const int rows) { (void)columns, (void)rows; }
+  void clear() {
+    memset(text_, ' ', sizeof(text_));
+    for (int row{0}; row < kRows; ++row) text_[row][kColumns] = '\0';
+    setCursor(0, 0);
+  }
+  void setCursor(const int column, const int row) {
+    column_ = column;
+    row_ = row;
+  }
+  void createChar(const int index, const uint8_t* const character) {
+    (void)index, (void)character;
+  }
+  size_t write(const uint8_t value) {
+    Put(value < 8 ? '#' : static_cast<char>(value));
+    return 1;
+  }
+  void print(const char* const text) {
+    for (const char* c{text}; *c; ++c) Put(*c);
+  }
+  void print(const int value) {
+    char text[12];
+    snprintf(text, sizeof(text), "%d", value);
+    print(text);
+  }
+
+  /**
+   * @param row The number of the row
+   *
+   * @returns The text shown in the specified row.
+   */
+  const char* Line(const int row) const { return text_[row]; }
+
+ private:
+  static constexpr int kColumns{16};
+  static constexpr int kRows{2};
+
+  void Put(const char value) {
+    if (column_ < kColumns && row_ < kRows) text_[row_][column_] = value;
+    ++column_;
+  }
+
+  static LiquidCrystal* instance_;
+
+  char text_[kRows][kColumns + 1];
+  int column_{0};
+  int row_{0};
+};
+
+#endif  // TETRIS_HOST_LIQUID_CRYSTAL_H_
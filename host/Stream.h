@@ -0,0 +1,32 @@
+#ifndef TETRIS_HOST_STREAM_H_
+#define TETRIS_HOST_STREAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The Print class is the base of every output stream.
+ */
+class Print {
+ public:
+  virtual ~Print() = default;
+
+  virtual size_t write(const uint8_t value) = 0;
+  virtual size_t write(const uint8_t* const data, const size_t size) {
+    for (size_t i{0}; i < size; ++i) write(data[i]);
+    return size;
+  }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+};
+
+/**
+ * The Stream class is the base of every input and output stream.
+ */
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+};
+
+#endif  // TETRIS_HOST_STREAM_H_
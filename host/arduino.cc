@@ -0,0 +1,93 @@
+#include "Arduino.h"
+
+#include <time.h>
+
+#include "EEPROM.h"
+#include "LiquidCrystal.h"
+
+HardwareSerial Serial;
+EEPROMClass EEPROM;
+LiquidCrystal* LiquidCrystal::instance_{nullptr};
+
+namespace {
+
+bool simulated_clock{false};
+unsigned long simulated_time{0};
+void (*idle_handler)(){nullptr};
+
+unsigned long release_times[kHostPins]{};
+void (*interrupt_handlers[kHostPins])(){};
+
+unsigned long RealTime() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1000UL + now.tv_nsec / 1000000;
+}
+
+bool Pressed(const int pin) {
+  return static_cast<long>(release_times[pin] - millis()) > 0;
+}
+
+}  // namespace
+
+unsigned long millis() {
+  static const unsigned long start{RealTime()};
+  return simulated_clock ? simulated_time : RealTime() - start;
+}
+
+void delay(const unsigned long duration) {
+  const unsigned long start{millis()};
+  while (millis() - start < duration) {
+    if (simulated_clock) {
+      ++simulated_time;
+    } else {
+      const timespec step{0, 1000000};
+      nanosleep(&step, nullptr);
+    }
+    if (idle_handler) idle_handler();
+  }
+}
+
+void pinMode(const int pin, const int mode) { (void)pin, (void)mode; }
+
+int digitalRead(const int pin) { return Pressed(pin) ? LOW : HIGH; }
+
+int analogRead(const int pin) {
+  (void)pin;
+  return 0;
+}
+
+int digitalPinToInterrupt(const int pin) { return pin; }
+
+void attachInterrupt(const int interrupt, void (*handler)(), const int mode) {
+  (void)mode;
+  interrupt_handlers[interrupt] = handler;
+}
+
+void randomSeed(const unsigned long seed) { srandom(seed); }
+
+long random(const long max) { return max > 0 ? ::random() % max : 0; }
+
+long random(const long min, const long max) {
+  return min < max ? min + ::random() % (max - min) : min;
+}
+
+namespace host {
+
+void UseSimulatedClock() { simulated_clock = true; }
+
+void AdvanceClock(const unsigned long duration) {
+  if (simulated_clock) simulated_time += duration;
+}
+
+void PressButton(const int pin, const unsigned long duration) {
+  const bool was_pressed{Pressed(pin)};
+  release_times[pin] = millis() + duration;
+  if (!was_pressed && Pressed(pin) && interrupt_handlers[pin]) {
+    interrupt_handlers[pin]();
+  }
+}
+
+void SetIdleHandler(void (*handler)()) { idle_handler = handler; }
+
+}  // namespace host
@@ -0,0 +1,42 @@
+#include "fd_stream.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "Arduino.h"
+
+void FdStream::Attach(const int fd) {
+  fd_ = fd;
+  if (fd_ >= 0) fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+}
+
+int FdStream::available() {
+  int size{0};
+  if (fd_ < 0 || ioctl(fd_, FIONREAD, &size) < 0) return 0;
+  return size;
+}
+
+int FdStream::read() {
+  uint8_t value;
+  if (fd_ < 0 || ::read(fd_, &value, 1) != 1) return -1;
+  return value;
+}
+
+size_t FdStream::write(const uint8_t value) { return write(&value, 1); }
+
+size_t FdStream::write(const uint8_t* const data, const size_t size) {
+  if (fd_ < 0) return size;
+
+  const ssize_t written{::write(fd_, data, size)};
+  return written > 0 ? written : 0;
+}
+
+int FdStream::availableForWrite() {
+  if (fd_ < 0) return kTransmitBufferSize;
+
+  pollfd descriptor{fd_, POLLOUT, 0};
+  if (poll(&descriptor, 1, 0) != 1) return 0;
+  return (descriptor.revents & POLLOUT) ? kTransmitBufferSize : 0;
+}
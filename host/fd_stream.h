@@ -0,0 +1,36 @@
+#ifndef TETRIS_HOST_FD_STREAM_H_
+#define TETRIS_HOST_FD_STREAM_H_
+
+#include "Stream.h"
+
+/**
+ * The FdStream class is a non-blocking stream over a file descriptor, such as
+ * a pty, a serial device or one end of a socketpair. Two host instances
+ * connected this way stand in for two boards connected by their serial ports.
+ */
+class FdStream : public Stream {
+ public:
+  /**
+   * Connects the stream to the file descriptor and makes it non-blocking.
+   *
+   * @param fd The file descriptor, or -1 to disconnect the stream
+   */
+  void Attach(const int fd);
+
+  int available() override;
+  int read() override;
+  size_t write(const uint8_t value) override;
+  size_t write(const uint8_t* const data, const size_t size) override;
+  /**
+   * @returns The size of the serial transmit buffer if the descriptor accepts
+   * data without blocking, 0 otherwise.
+   */
+  int availableForWrite() override;
+
+ private:
+  static constexpr int kTransmitBufferSize{64};
+
+  int fd_{-1};
+};
+
+#endif  // TETRIS_HOST_FD_STREAM_H_
@@ -0,0 +1,78 @@
+// Runs the game on simulated time without a serial connection and checks that
+// the scheduler keeps the MCU asleep between game ticks. Exits with a failure
+// status if the duty cycle regresses.
+//
+// Build and run from the repository root:
+//   g++ -std=c++11 -Ihost -I. -include Arduino.h -o scheduler_check
+//       host/scheduler_check.cc host/arduino.cc host/fd_stream.cc *.cc
+//   ./scheduler_check
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "game.h"
+
+extern Game game;
+
+void setup();
+void loop();
+
+namespace {
+
+constexpr unsigned long kRunTime{20000};
+constexpr unsigned long kButtonPressTime{10000};
+// Simulated time charged for every pass of `loop`, which is a generous
+// estimate of a game tick with a full LCD redraw at 16 MHz
+constexpr unsigned long kLoopWorkTime{2};
+
+// Gravity ticks, spawns and telemetry frames, with some headroom
+constexpr unsigned long kMaxSleepsPerSecond{2 * 1000 / kMoveTimeDelay + 4};
+// Deep sleep steps of 16 ms plus the idle remainder of every tick
+constexpr unsigned long kMaxCpuWakeupsPerSecond{150};
+constexpr unsigned long kMinSleepPercentage{99};
+
+bool Check(const bool condition, const char* const message) {
+  if (!condition) fprintf(stderr, "FAILED: %s\n", message);
+  return condition;
+}
+
+}  // namespace
+
+int main() {
+  host::UseSimulatedClock();
+  setup();
+
+  const unsigned long start{millis()};
+  bool pressed{false};
+  while (millis() - start < kRunTime) {
+    if (!pressed && millis() - start >= kButtonPressTime) {
+      host::PressButton(kLeftButtonPin, 1);
+      pressed = true;
+    }
+    loop();
+    host::AdvanceClock(kLoopWorkTime);
+  }
+
+  const Scheduler::Statistics stats{game.SchedulerStats()};
+  const unsigned long seconds{(stats.sleep_time + stats.awake_time) / 1000};
+  printf("sleeps:         %lu (%lu timeouts, %lu input, %lu stream)\n",
+         stats.sleeps, stats.timeouts, stats.input_wakeups,
+         stats.stream_wakeups);
+  printf("cpu wakeups:    %lu (%lu per second)\n", stats.cpu_wakeups,
+         stats.cpu_wakeups / seconds);
+  printf("sleep time:     %lu ms of %lu ms\n", stats.sleep_time,
+         stats.sleep_time + stats.awake_time);
+
+  bool passed{true};
+  passed &= Check(stats.sleeps <= kMaxSleepsPerSecond * seconds,
+                  "the game wakes up more often than its ticks");
+  passed &= Check(stats.cpu_wakeups <= kMaxCpuWakeupsPerSecond * seconds,
+                  "the CPU is woken up too often while sleeping");
+  passed &= Check(stats.input_wakeups >= 1,
+                  "a button press did not end the sleep");
+  passed &= Check(stats.sleep_time * 100 >=
+                      kMinSleepPercentage * (stats.sleep_time +
+                                             stats.awake_time),
+                  "the MCU is awake for too long");
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,157 @@
+// Runs the game in a Linux terminal. The serial port can be connected to a
+// pty, a serial device or an inherited socket, so two instances can play in
+// versus mode without any boards.
+//
+// Build from the repository root:
+//   g++ -std=c++11 -Ihost -I. -include Arduino.h -o tetris host/tetris.cc
+//       host/arduino.cc host/fd_stream.cc *.cc
+//
+// Play versus over a pair of ptys, each instance in its own terminal:
+//   socat pty,raw,echo=0,link=/tmp/tetris-a pty,raw,echo=0,link=/tmp/tetris-b
+//   ./tetris --versus /tmp/tetris-a
+//   ./tetris --versus /tmp/tetris-b
+//
+// Use `--fd N` instead of a path to play over an inherited descriptor, e.g.
+// one end of a socketpair. Without `--versus` the serial port carries the
+// telemetry instead. Keys: a/d move, w rotate, s rapid fall, u undo, q quit.
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "game.h"
+
+extern Game game;
+
+namespace {
+
+constexpr unsigned long kKeyHoldTime{30};
+constexpr unsigned long kRenderInterval{50};
+
+termios original_terminal;
+
+void RestoreTerminal() { tcsetattr(STDIN_FILENO, TCSANOW, &original_terminal); }
+
+void SetupTerminal() {
+  tcgetattr(STDIN_FILENO, &original_terminal);
+  atexit(RestoreTerminal);
+
+  termios terminal{original_terminal};
+  terminal.c_lflag &= ~(ICANON | ECHO);
+  terminal.c_cc[VMIN] = 0;
+  terminal.c_cc[VTIME] = 0;
+  tcsetattr(STDIN_FILENO, TCSANOW, &terminal);
+
+  // Keys may also come from a pipe, which ignores the terminal settings
+  fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+}
+
+void ReadKeys() {
+  char key;
+  while (read(STDIN_FILENO, &key, 1) == 1) {
+    switch (key) {
+      case 'a':
+        host::PressButton(kLeftButtonPin, kKeyHoldTime);
+        break;
+      case 'd':
+        host::PressButton(kRightButtonPin, kKeyHoldTime);
+        break;
+      case 'w':
+        host::PressButton(kRotateButtonPin, kKeyHoldTime);
+        break;
+      case 's':
+        host::PressButton(kRapidFallButtonPin, kKeyHoldTime);
+        break;
+      case 'u':
+        host::PressButton(kLeftButtonPin, kKeyHoldTime);
+        host::PressButton(kRightButtonPin, kKeyHoldTime);
+        break;
+      case 'q':
+        exit(EXIT_SUCCESS);
+    }
+  }
+}
+
+void Render() {
+  static std::string last_screen;
+
+  std::string screen;
+  const LiquidCrystal* const lcd{LiquidCrystal::Instance()};
+  if (lcd) {
+    screen += "+----------------+\n";
+    for (int row{0}; row < 2; ++row) {
+      screen += std::string("|") + lcd->Line(row) + "|\n";
+    }
+    screen += "+----------------+\n";
+  }
+
+  const GameState state{game.Snapshot()};
+  Board board{state.board};
+  if (state.has_tetromino) state.tetromino.Draw(board, true);
+  for (int y{0}; y < Board::Height(); ++y) {
+    screen += '|';
+    for (int x{0}; x < Board::Width(); ++x) {
+      screen += board.At(x, y) ? '#' : '.';
+    }
+    screen += "|\n";
+  }
+
+  if (screen == last_screen) return;
+  last_screen = screen;
+  printf("\x1b[H\x1b[2J%s", screen.c_str());
+  fflush(stdout);
+}
+
+void OnIdle() {
+  static unsigned long last_render{0};
+
+  ReadKeys();
+  if (millis() - last_render >= kRenderInterval) {
+    Render();
+    last_render = millis();
+  }
+}
+
+int OpenSerial(const int argc, char** const argv) {
+  if (argc == 2 && strcmp(argv[0], "--fd") == 0) return atoi(argv[1]);
+  if (argc == 1) return open(argv[0], O_RDWR | O_NOCTTY);
+  return -1;
+}
+
+}  // namespace
+
+void setup();
+void loop();
+
+int main(int argc, char** argv) {
+  const bool versus{argc > 1 && strcmp(argv[1], "--versus") == 0};
+  const int first_argument{versus ? 2 : 1};
+  if (argc - first_argument > 2) {
+    fprintf(stderr, "usage: %s [--versus] [device | --fd N]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const int fd{OpenSerial(argc - first_argument, argv + first_argument)};
+  if (argc > first_argument && fd < 0) {
+    perror("serial port");
+    return EXIT_FAILURE;
+  }
+  Serial.Attach(fd);
+
+  SetupTerminal();
+  host::SetIdleHandler(OnIdle);
+
+  // Holding "rotate" through the intro selects versus mode
+  if (versus) host::PressButton(kRotateButtonPin, kIntroDelay + kKeyHoldTime);
+  setup();
+  for (;;) {
+    loop();
+    ReadKeys();
+    Render();
+  }
+}
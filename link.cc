@@ -0,0 +1,114 @@
+#include "link.h"
+
+void Link::QueueGarbage(const int lines) {
+  if (lines <= 0) return;
+
+  sent_garbage_ += lines;
+  pending_ = true;
+}
+
+void Link::QueueSummary(const Board& board) {
+  for (int x{0}; x < Board::Width(); ++x) {
+    int y{0};
+    while (y < Board::Height() && !board.At(x, y)) ++y;
+
+    const uint8_t height{static_cast<uint8_t>(Board::Height() - y)};
+    if (heights_[x] != height) {
+      heights_[x] = height;
+      changed_columns_ |= 1U << x;
+      pending_ = true;
+    }
+  }
+}
+
+bool Link::Poll() {
+  bool changes{false};
+
+  while (stream_.available() > 0) {
+    if (reader_.Feed(stream_.read()) && HandleFrame()) changes = true;
+  }
+  if (pending_) Send();
+
+  return changes;
+}
+
+int Link::TakeGarbage() {
+  // A lower total means that the other game was restarted
+  if (received_garbage_ < applied_garbage_) applied_garbage_ = received_garbage_;
+
+  const int lines{received_garbage_ - applied_garbage_};
+  applied_garbage_ = received_garbage_;
+  return lines;
+}
+
+void Link::DiscardGarbage() { applied_garbage_ = received_garbage_; }
+
+int Link::OpponentHeight() const {
+  int height{0};
+  for (int x{0}; x < Board::Width(); ++x) {
+    if (opponent_heights_[x] > height) height = opponent_heights_[x];
+  }
+  return height;
+}
+
+void Link::Send() {
+  const uint16_t columns{frames_since_keyframe_ == 0 ? kAllColumns
+                                                     : changed_columns_};
+
+  uint8_t payload[4 + Board::Width()];
+  int size{0};
+  payload[size++] = sent_garbage_ & 0xFF;
+  payload[size++] = sent_garbage_ >> 8;
+  payload[size++] = columns & 0xFF;
+  payload[size++] = columns >> 8;
+  for (int x{0}; x < Board::Width(); ++x) {
+    if ((columns >> x) & 1) payload[size++] = heights_[x];
+  }
+
+  uint8_t frame[kFrameMaxSize];
+  const int length{
+      EncodeFrame(frame, FrameType::kVersus, tx_sequence_, payload, size)};
+  if (!transmitter_.Write(frame, length)) return;
+
+  ++tx_sequence_;
+  changed_columns_ = 0;
+  frames_since_keyframe_ = (frames_since_keyframe_ + 1) % kKeyframeInterval;
+  pending_ = false;
+}
+
+bool Link::HandleFrame() {
+  if (reader_.Type() != FrameType::kVersus) return false;
+
+  const uint8_t* const payload{reader_.Payload()};
+  const int size{reader_.PayloadSize()};
+  if (size < 4) return false;
+
+  const uint16_t garbage{static_cast<uint16_t>(payload[0] | payload[1] << 8)};
+  const uint16_t columns{static_cast<uint16_t>(payload[2] | payload[3] << 8)};
+
+  int count{0};
+  for (int x{0}; x < Board::Width(); ++x) {
+    if ((columns >> x) & 1) ++count;
+  }
+  if (size != 4 + count) return false;
+
+  // Garbage sent before this game was listening is not applied
+  if (!connected_) applied_garbage_ = garbage;
+  received_garbage_ = garbage;
+  connected_ = true;
+
+  // Column changes are only valid on top of every previous frame
+  if (columns == kAllColumns) {
+    synchronized_ = true;
+  } else if (reader_.Sequence() != rx_sequence_) {
+    synchronized_ = false;
+  }
+  rx_sequence_ = reader_.Sequence() + 1;
+  if (!synchronized_) return false;
+
+  int index{4};
+  for (int x{0}; x < Board::Width(); ++x) {
+    if ((columns >> x) & 1) opponent_heights_[x] = payload[index++];
+  }
+  return count > 0;
+}
@@ -0,0 +1,112 @@
+#ifndef TETRIS_LINK_H_
+#define TETRIS_LINK_H_
+
+#include <Arduino.h>
+
+#include "board.h"
+#include "frame.h"
+#include "transmit_buffer.h"
+
+/**
+ * The Link class connects two games in versus mode. Each side sends the total
+ * number of garbage lines it has produced and the column heights of its board
+ * that changed since the previous frame. Every few frames all heights are
+ * sent again, so a lost frame is corrected quickly.
+ *
+ * Both sending and receiving are non-blocking. Any stream can be used, e.g.
+ * `Serial` on the device or a pty or socketpair on a host build.
+ */
+class Link {
+ public:
+  /**
+   * @param stream The stream connected to the other game
+   * @param transmitter The transmit buffer of the same stream
+   */
+  Link(Stream& stream, TransmitBuffer& transmitter)
+      : stream_{stream}, transmitter_{transmitter} {}
+
+  /**
+   * Adds garbage lines to be sent to the other game.
+   *
+   * @param lines The number of garbage lines
+   */
+  void QueueGarbage(const int lines);
+  /**
+   * Compares the column heights of the board with the ones already sent and
+   * queues the changed ones.
+   *
+   * @param board The local game board
+   */
+  void QueueSummary(const Board& board);
+  /**
+   * Processes the received frames and queues a frame with the changes, if
+   * there is enough room in the transmit buffer.
+   *
+   * @returns True if the state of the other game changed, false otherwise.
+   */
+  bool Poll();
+  /**
+   * Returns the garbage lines received since the last call and marks them as
+   * applied.
+   *
+   * @returns The number of garbage lines to insert into the board.
+   */
+  int TakeGarbage();
+  /**
+   * Marks all garbage lines received so far as applied, e.g. after the game
+   * restarts.
+   */
+  void DiscardGarbage();
+
+  /**
+   * @returns True if any changes are still waiting to be sent.
+   */
+  bool Pending() const { return pending_; }
+  /**
+   * @returns True if any frame was received from the other game.
+   */
+  bool Connected() const { return connected_; }
+  /**
+   * @returns The height of the highest column on the other game's board.
+   */
+  int OpponentHeight() const;
+
+ private:
+  static constexpr int kKeyframeInterval{8};
+  static constexpr uint16_t kAllColumns{
+      static_cast<uint16_t>((1UL << Board::Width()) - 1)};
+
+  static_assert(4 + Board::Width() <= kFrameMaxPayloadSize,
+                "A keyframe must fit in a single frame");
+
+  /**
+   * Sends the queued changes in a single frame.
+   */
+  void Send();
+  /**
+   * Applies the last frame received by the reader.
+   *
+   * @returns True if the state of the other game changed, false otherwise.
+   */
+  bool HandleFrame();
+
+  Stream& stream_;
+  TransmitBuffer& transmitter_;
+  FrameReader reader_;
+
+  uint8_t tx_sequence_{0};
+  uint16_t sent_garbage_{0};
+  uint8_t heights_[Board::Width()]{};
+  uint16_t changed_columns_{0};
+  int frames_since_keyframe_{0};
+  bool pending_{false};
+
+  uint8_t rx_sequence_{0};
+  uint16_t received_garbage_{0};
+  uint16_t applied_garbage_{0};
+  uint8_t opponent_heights_[Board::Width()]{};
+  bool connected_{false};
+  bool synchronized_{false};
+};
+
+#endif  // TETRIS_LINK_H_
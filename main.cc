@@ -4,4 +4,8 @@ Game game;
 
 void setup() { game.Setup(); }
 
-void loop() { game.Update(); }
\ No newline at end of file
+void loop() {
+  game.Update();
+  game.Report();
+  game.Sleep();
+}
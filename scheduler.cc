@@ -0,0 +1,150 @@
+#include "scheduler.h"
+
+#ifdef __AVR__
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+
+// Defined by the Arduino core and advanced by the timer 0 interrupt
+extern "C" volatile unsigned long timer0_millis;
+#endif
+
+namespace {
+
+volatile bool input_event{false};
+
+#ifdef __AVR__
+volatile bool watchdog_event{false};
+
+/**
+ * Stops the CPU until the next interrupt, unless a button has already changed
+ * its state.
+ *
+ * @param mode The AVR sleep mode
+ * @param wake_on_input True if a pending button change should skip the sleep
+ */
+void SleepCpu(const uint8_t mode, const bool wake_on_input) {
+  set_sleep_mode(mode);
+  noInterrupts();
+  if (wake_on_input && input_event) {
+    interrupts();
+    return;
+  }
+  sleep_enable();
+  interrupts();
+  sleep_cpu();
+  sleep_disable();
+}
+#else
+void OnInput() { input_event = true; }
+#endif
+
+}  // namespace
+
+#ifdef __AVR__
+ISR(PCINT0_vect) { input_event = true; }
+ISR(PCINT1_vect, ISR_ALIASOF(PCINT0_vect));
+ISR(PCINT2_vect, ISR_ALIASOF(PCINT0_vect));
+ISR(WDT_vect) { watchdog_event = true; }
+#endif
+
+void Scheduler::Setup(const int* const pins, const int size, Stream& stream) {
+#ifdef __AVR__
+  for (int i{0}; i < size; ++i) {
+    *digitalPinToPCMSK(pins[i]) |= _BV(digitalPinToPCMSKbit(pins[i]));
+    PCICR |= _BV(digitalPinToPCICRbit(pins[i]));
+  }
+#else
+  // The host shim reports button changes through emulated interrupts
+  for (int i{0}; i < size; ++i) {
+    attachInterrupt(digitalPinToInterrupt(pins[i]), OnInput, CHANGE);
+  }
+#endif
+
+  stream_ = &stream;
+  start_time_ = millis();
+  sleeps_ = 0;
+  timeouts_ = 0;
+  input_wakeups_ = 0;
+  stream_wakeups_ = 0;
+  cpu_wakeups_ = 0;
+  sleep_time_ = 0;
+}
+
+void Scheduler::Sleep(const unsigned long duration, const Mode mode) {
+  ++sleeps_;
+  switch (SleepFor(duration, mode, true)) {
+    case Wakeup::kTimeout:
+      ++timeouts_;
+      break;
+    case Wakeup::kInput:
+      ++input_wakeups_;
+      break;
+    case Wakeup::kStream:
+      ++stream_wakeups_;
+      break;
+  }
+  input_event = false;
+}
+
+void Scheduler::Delay(const unsigned long duration, const Mode mode) {
+  SleepFor(duration, mode, false);
+}
+
+Scheduler::Statistics Scheduler::Stats() const {
+  const unsigned long elapsed{millis() - start_time_};
+  return {sleeps_,      timeouts_,   input_wakeups_,         stream_wakeups_,
+          cpu_wakeups_, sleep_time_, elapsed - sleep_time_};
+}
+
+Scheduler::Wakeup Scheduler::SleepFor(const unsigned long duration,
+                                      const Mode mode,
+                                      const bool wake_early) {
+  const unsigned long start{millis()};
+  Wakeup wakeup{Wakeup::kTimeout};
+
+  while (millis() - start < duration) {
+    if (wake_early && input_event) {
+      wakeup = Wakeup::kInput;
+      break;
+    }
+    if (wake_early && mode == Mode::kListen && stream_->available() > 0) {
+      wakeup = Wakeup::kStream;
+      break;
+    }
+
+    const bool deep{mode == Mode::kDeep &&
+                    duration - (millis() - start) >= kDeepSleepStep};
+#ifdef __AVR__
+    if (deep) {
+      watchdog_event = false;
+      noInterrupts();
+      MCUSR &= ~_BV(WDRF);
+      WDTCSR = _BV(WDCE) | _BV(WDE);
+      WDTCSR = _BV(WDIE);  // Interrupt only, 16 ms
+      interrupts();
+
+      SleepCpu(SLEEP_MODE_PWR_DOWN, wake_early);
+      wdt_disable();
+
+      // Timer 0 stands still while powered down. A button wakeup cannot
+      // tell how much of the step has passed, so half of it is assumed.
+      noInterrupts();
+      timer0_millis += watchdog_event ? kDeepSleepStep : kDeepSleepStep / 2;
+      interrupts();
+    } else {
+      SleepCpu(SLEEP_MODE_IDLE, wake_early);
+    }
+#else
+    const unsigned long step{deep ? kDeepSleepStep : 1};
+    for (unsigned long i{0}; i < step; ++i) {
+      if (wake_early && input_event) break;
+      delay(1);
+    }
+#endif
+    ++cpu_wakeups_;
+  }
+
+  sleep_time_ += millis() - start;
+  return wakeup;
+}
@@ -0,0 +1,114 @@
+#ifndef TETRIS_SCHEDULER_H_
+#define TETRIS_SCHEDULER_H_
+
+#include <Arduino.h>
+
+/**
+ * The Scheduler class puts the MCU to sleep between game ticks. Instead of
+ * spinning in `loop()`, the game asks it to sleep until the next deadline.
+ * A pin change interrupt on any watched button or data received on the watched
+ * stream wakes it up earlier. It also counts how every sleep ended and how
+ * often the CPU woke up, so the duty cycle can be measured.
+ */
+class Scheduler {
+ public:
+  /**
+   * The Mode enum selects how deep the MCU sleeps.
+   *
+   * In `kIdle` and `kListen` modes the CPU is stopped but the peripherals keep
+   * running, so serial data is still sent and received. Timer 0 keeps
+   * `millis` running, which also wakes the CPU every millisecond. `kListen`
+   * additionally ends the sleep as soon as the watched stream receives data.
+   *
+   * In `kDeep` mode the MCU is powered down and woken by the watchdog in
+   * steps of `kDeepSleepStep`. The serial port does not work, so it has to be
+   * idle. `millis` is corrected after every step.
+   */
+  enum class Mode {
+    kIdle,
+    kListen,
+    kDeep,
+  };
+
+  /**
+   * The Statistics struct holds the counters collected since `Setup`.
+   */
+  struct Statistics {
+    unsigned long sleeps;
+    unsigned long timeouts;
+    unsigned long input_wakeups;
+    unsigned long stream_wakeups;
+    unsigned long cpu_wakeups;
+    unsigned long sleep_time;
+    unsigned long awake_time;
+  };
+
+  /**
+   * Resets the counters and enables the pin change interrupts for the
+   * specified button pins.
+   *
+   * @param pins The button pins to watch
+   * @param size The number of pins
+   * @param stream The stream to watch for received data
+   */
+  void Setup(const int* const pins, const int size, Stream& stream);
+  /**
+   * Sleeps for the specified time, until any watched button changes its state
+   * or, in `kListen` mode, until the watched stream receives data, whichever
+   * comes first.
+   *
+   * @param duration The maximum sleep time in milliseconds
+   * @param mode The sleep mode
+   */
+  void Sleep(const unsigned long duration, const Mode mode);
+  /**
+   * Sleeps for the whole specified time, ignoring the buttons and received
+   * data. It is a low power replacement for `delay`.
+   *
+   * @param duration The sleep time in milliseconds
+   * @param mode The sleep mode
+   */
+  void Delay(const unsigned long duration, const Mode mode);
+
+  /**
+   * @returns The counters collected since `Setup`.
+   */
+  Statistics Stats() const;
+
+ private:
+  static constexpr unsigned long kDeepSleepStep{16};
+
+  /**
+   * The Wakeup enum tells why a sleep ended.
+   */
+  enum class Wakeup {
+    kTimeout,
+    kInput,
+    kStream,
+  };
+
+  /**
+   * Sleeps in steps until the specified time has passed.
+   *
+   * @param duration The sleep time in milliseconds
+   * @param mode The sleep mode
+   * @param wake_early True if a button change or, in `kListen` mode, received
+   * data should end the sleep early
+   *
+   * @returns The reason why the sleep ended.
+   */
+  Wakeup SleepFor(const unsigned long duration, const Mode mode,
+                  const bool wake_early);
+
+  Stream* stream_{nullptr};
+
+  unsigned long start_time_{0};
+  unsigned long sleeps_{0};
+  unsigned long timeouts_{0};
+  unsigned long input_wakeups_{0};
+  unsigned long stream_wakeups_{0};
+  unsigned long cpu_wakeups_{0};
+  unsigned long sleep_time_{0};
+};
+
+#endif  // TETRIS_SCHEDULER_H_
@@ -0,0 +1,41 @@
+#include "telemetry.h"
+
+void Telemetry::Record(const Board& board, const Tetromino* const tetromino,
+                       const int score, const uint8_t buttons) {
+  Board layer;
+  layer.Clear();
+  if (tetromino) tetromino->Draw(layer, true);
+
+  uint8_t image[kTelemetryImageSize];
+  for (int y{0}; y < Board::Height(); ++y) {
+    image[kTelemetryBoardOffset + 2 * y] = board.Row(y) & 0xFF;
+    image[kTelemetryBoardOffset + 2 * y + 1] = board.Row(y) >> 8;
+    image[kTelemetryTetrominoOffset + 2 * y] = layer.Row(y) & 0xFF;
+    image[kTelemetryTetrominoOffset + 2 * y + 1] = layer.Row(y) >> 8;
+  }
+  image[kTelemetryScoreOffset] = score & 0xFF;
+  image[kTelemetryScoreOffset + 1] = (score >> 8) & 0xFF;
+  image[kTelemetryButtonsOffset] = buttons;
+
+  const bool keyframe{frames_since_keyframe_ == 0};
+  if (!keyframe && memcmp(image, image_, kTelemetryImageSize) == 0) return;
+
+  uint8_t payload[1 + MaxDeltaSize(kTelemetryImageSize)];
+  payload[0] = keyframe ? kTelemetryKeyframeFlag : 0;
+  const int size{1 + EncodeDelta(keyframe ? nullptr : image_, image,
+                                 kTelemetryImageSize, payload + 1)};
+
+  uint8_t frame[kFrameMaxSize];
+  const int length{
+      EncodeFrame(frame, FrameType::kTelemetry, sequence_, payload, size)};
+  ++sequence_;
+
+  if (!transmitter_.Write(frame, length)) {
+    // The decoder cannot apply the next difference without this one
+    frames_since_keyframe_ = 0;
+    return;
+  }
+
+  memcpy(image_, image, kTelemetryImageSize);
+  frames_since_keyframe_ = (frames_since_keyframe_ + 1) % kKeyframeInterval;
+}
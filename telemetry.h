@@ -0,0 +1,54 @@
+#ifndef TETRIS_TELEMETRY_H_
+#define TETRIS_TELEMETRY_H_
+
+#include <Arduino.h>
+
+#include "board.h"
+#include "frame.h"
+#include "telemetry_codec.h"
+#include "tetromino.h"
+#include "transmit_buffer.h"
+
+/**
+ * The Telemetry class streams the live game state for monitoring. Each frame
+ * holds only the run-length encoded difference from the previously sent
+ * state, and nothing is sent while the state does not change. A full state is
+ * sent every few frames and after any dropped frame, so a decoder can join the
+ * stream at any time.
+ *
+ * Frames are queued in a non-blocking transmit buffer, so the game never waits
+ * for the serial port.
+ */
+class Telemetry {
+ public:
+  /**
+   * @param transmitter The transmit buffer to queue the frames in
+   */
+  explicit Telemetry(TransmitBuffer& transmitter)
+      : transmitter_{transmitter} {}
+
+  /**
+   * Queues a frame with the changes since the last recorded state, if any.
+   *
+   * @param board The game board
+   * @param tetromino The current tetromino (optional)
+   * @param score The current score
+   * @param buttons The bit mask of the pressed buttons
+   */
+  void Record(const Board& board, const Tetromino* const tetromino,
+              const int score, const uint8_t buttons);
+
+ private:
+  static constexpr int kKeyframeInterval{32};
+
+  static_assert(1 + MaxDeltaSize(kTelemetryImageSize) <= kFrameMaxPayloadSize,
+                "A keyframe must fit in a single frame");
+
+  TransmitBuffer& transmitter_;
+
+  uint8_t image_[kTelemetryImageSize]{};
+  uint8_t sequence_{0};
+  int frames_since_keyframe_{0};
+};
+
+#endif  // TETRIS_TELEMETRY_H_
@@ -0,0 +1,68 @@
+#include "telemetry_codec.h"
+
+namespace {
+
+constexpr int kMaxRun{128};
+constexpr uint8_t kRunFlag{0x80};
+
+uint8_t Difference(const uint8_t* const previous,
+                   const uint8_t* const current, const int index) {
+  return previous ? previous[index] ^ current[index] : current[index];
+}
+
+}  // namespace
+
+int EncodeDelta(const uint8_t* const previous, const uint8_t* const current,
+                const int size, uint8_t* const output) {
+  int end{size};
+  while (end > 0 && Difference(previous, current, end - 1) == 0) --end;
+
+  int length{0};
+  int i{0};
+  while (i < end) {
+    const int start{i};
+
+    if (Difference(previous, current, i) == 0) {
+      while (i < end && i - start < kMaxRun &&
+             Difference(previous, current, i) == 0) {
+        ++i;
+      }
+      output[length++] = kRunFlag | (i - start - 1);
+    } else {
+      // A single unchanged byte is cheaper to keep inside the literal
+      while (i < end && i - start < kMaxRun &&
+             (Difference(previous, current, i) != 0 ||
+              (i + 1 < end && Difference(previous, current, i + 1) != 0))) {
+        ++i;
+      }
+      output[length++] = i - start - 1;
+      for (int j{start}; j < i; ++j) {
+        output[length++] = Difference(previous, current, j);
+      }
+    }
+  }
+
+  return length;
+}
+
+bool DecodeDelta(const uint8_t* const input, const int size,
+                 uint8_t* const image, const int image_size) {
+  int position{0};
+  int i{0};
+  while (i < size) {
+    const uint8_t token{input[i++]};
+    const int count{(token & ~kRunFlag) + 1};
+    if (position + count > image_size) return false;
+
+    if (token & kRunFlag) {
+      position += count;
+    } else {
+      if (i + count > size) return false;
+      for (int j{0}; j < count; ++j) {
+        image[position++] ^= input[i++];
+      }
+    }
+  }
+
+  return true;
+}
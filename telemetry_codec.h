@@ -0,0 +1,72 @@
+#ifndef TETRIS_TELEMETRY_CODEC_H_
+#define TETRIS_TELEMETRY_CODEC_H_
+
+#include <stdint.h>
+
+#include "board.h"
+
+/**
+ * Telemetry frames describe the game as a fixed size image with the
+ * following layout, all multi-byte values being little-endian:
+ *
+ *   board rows (2 bytes each) | tetromino rows (2 bytes each) | score (2
+ *   bytes) | pressed buttons (1 byte)
+ *
+ * The first payload byte holds the flags below, the rest is the image encoded
+ * with `EncodeDelta`.
+ */
+constexpr int kTelemetryBoardOffset{0};
+constexpr int kTelemetryTetrominoOffset{kTelemetryBoardOffset +
+                                        2 * Board::Height()};
+constexpr int kTelemetryScoreOffset{kTelemetryTetrominoOffset +
+                                    2 * Board::Height()};
+constexpr int kTelemetryButtonsOffset{kTelemetryScoreOffset + 2};
+constexpr int kTelemetryImageSize{kTelemetryButtonsOffset + 1};
+
+constexpr uint8_t kTelemetryKeyframeFlag{0x01};
+
+/**
+ * The pressed buttons are stored as a bit mask of the values below.
+ */
+constexpr uint8_t kTelemetryLeftButton{0x01};
+constexpr uint8_t kTelemetryRightButton{0x02};
+constexpr uint8_t kTelemetryRotateButton{0x04};
+constexpr uint8_t kTelemetryRapidFallButton{0x08};
+
+/**
+ * @param size The size of the image in bytes
+ *
+ * @returns The maximum number of bytes produced by `EncodeDelta`.
+ */
+constexpr int MaxDeltaSize(const int size) { return size + (size + 127) / 128; }
+
+/**
+ * Encodes the XOR difference between two images with run-length encoding.
+ * Every token starts with a byte, where a set high bit means a run of up to
+ * 128 unchanged bytes, and a clear high bit means up to 128 literal XOR bytes
+ * that follow. The count is stored minus one in the low bits. Unchanged bytes
+ * at the end are omitted.
+ *
+ * @param previous The image known to the receiver, or nullptr for a keyframe
+ * @param current The image to send
+ * @param size The size of both images in bytes
+ * @param output The buffer for at least `MaxDeltaSize(size)` bytes
+ *
+ * @returns The number of bytes written to the output.
+ */
+int EncodeDelta(const uint8_t* const previous, const uint8_t* const current,
+                const int size, uint8_t* const output);
+/**
+ * Applies a difference encoded with `EncodeDelta` to the image.
+ *
+ * @param input The encoded difference
+ * @param size The number of encoded bytes
+ * @param image The image to update, all zeros for a keyframe
+ * @param image_size The size of the image in bytes
+ *
+ * @returns True if the input was valid, false otherwise.
+ */
+bool DecodeDelta(const uint8_t* const input, const int size,
+                 uint8_t* const image, const int image_size);
+
+#endif  // TETRIS_TELEMETRY_CODEC_H_
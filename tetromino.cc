@@ -1,10 +1,9 @@
 #include "tetromino.h"
 
-Tetromino::Tetromino() {
+Tetromino::Tetromino(const int figure) {
   constexpr int x{Board::Width() / 2};
   constexpr int y{0};
 
-  const int figure{random(kFiguresSize)};
   for (int i{0}; i < kFigureSize; ++i) {
     shape_[i].x = x + kFigures[figure][i] % 2;
     shape_[i].y = y + kFigures[figure][i] / 2;
@@ -32,10 +32,17 @@ class Tetromino {
   };
 
   /**
-   * The Tetromino class constructor creates a new Tetromino object of a random
-   * figure from the set of pre-defined figures.
+   * Creates an empty tetromino. It is only meant to be overwritten by a real
+   * figure, which keeps the class trivially copyable.
    */
-  Tetromino();
+  Tetromino() = default;
+  /**
+   * Creates a new Tetromino object of the specified figure from the set of
+   * pre-defined figures, placed at the top of the board.
+   *
+   * @param figure The index of the figure in `kFigures`
+   */
+  explicit Tetromino(const int figure);
 
   /**
    * Checks if the tetromino collides with any other blocks on the game board.
@@ -92,8 +99,8 @@ class Tetromino {
    * respectively.
    */
   struct Block {
-    int x;
-    int y;
+    int8_t x;
+    int8_t y;
   };
 
   Block shape_[kFigureSize];
@@ -0,0 +1,94 @@
+// Decodes the telemetry stream sent by the game and prints every frame.
+//
+// Build on the host from this directory:
+//   g++ -std=c++11 -I.. -o telemetry_decoder telemetry_decoder.cc
+//       ../crc.cc ../frame.cc ../telemetry_codec.cc
+//
+// Usage:
+//   stty -F /dev/ttyACM0 115200 raw && ./telemetry_decoder < /dev/ttyACM0
+
+#include <stdio.h>
+
+#include "board.h"
+#include "frame.h"
+#include "telemetry_codec.h"
+
+namespace {
+
+int ReadRow(const uint8_t* const image, const int offset, const int y) {
+  return image[offset + 2 * y] | image[offset + 2 * y + 1] << 8;
+}
+
+void PrintFrame(const uint8_t sequence, const uint8_t* const image) {
+  const int score{image[kTelemetryScoreOffset] |
+                  image[kTelemetryScoreOffset + 1] << 8};
+  const uint8_t buttons{image[kTelemetryButtonsOffset]};
+
+  printf("frame %3d  score %4d  buttons %c%c%c%c\n", sequence, score,
+         buttons & kTelemetryLeftButton ? 'L' : '-',
+         buttons & kTelemetryRightButton ? 'R' : '-',
+         buttons & kTelemetryRotateButton ? 'U' : '-',
+         buttons & kTelemetryRapidFallButton ? 'D' : '-');
+
+  for (int y{0}; y < Board::Height(); ++y) {
+    const int board{ReadRow(image, kTelemetryBoardOffset, y)};
+    const int tetromino{ReadRow(image, kTelemetryTetrominoOffset, y)};
+
+    putchar('|');
+    for (int x{0}; x < Board::Width(); ++x) {
+      if ((tetromino >> x) & 1) {
+        putchar('@');
+      } else if ((board >> x) & 1) {
+        putchar('#');
+      } else {
+        putchar('.');
+      }
+    }
+    puts("|");
+  }
+  putchar('\n');
+}
+
+}  // namespace
+
+int main() {
+  FrameReader reader;
+  uint8_t image[kTelemetryImageSize]{};
+  uint8_t next_sequence{0};
+  bool synchronized{false};
+
+  int value;
+  while ((value = getchar()) != EOF) {
+    if (!reader.Feed(value) || reader.Type() != FrameType::kTelemetry) {
+      continue;
+    }
+
+    const uint8_t* const payload{reader.Payload()};
+    const int size{reader.PayloadSize()};
+    if (size < 1) continue;
+
+    const bool keyframe{(payload[0] & kTelemetryKeyframeFlag) != 0};
+    if (synchronized && !keyframe && reader.Sequence() != next_sequence) {
+      printf("lost frames %d-%d, waiting for a keyframe\n\n", next_sequence,
+             static_cast<uint8_t>(reader.Sequence() - 1));
+      synchronized = false;
+    }
+    next_sequence = reader.Sequence() + 1;
+
+    if (keyframe) {
+      for (int i{0}; i < kTelemetryImageSize; ++i) image[i] = 0;
+      synchronized = true;
+    }
+    if (!synchronized) continue;
+
+    if (!DecodeDelta(payload + 1, size - 1, image, kTelemetryImageSize)) {
+      printf("invalid frame %d, waiting for a keyframe\n\n", reader.Sequence());
+      synchronized = false;
+      continue;
+    }
+
+    PrintFrame(reader.Sequence(), image);
+  }
+
+  return 0;
+}
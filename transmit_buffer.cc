@@ -0,0 +1,25 @@
+#include "transmit_buffer.h"
+
+bool TransmitBuffer::Write(const uint8_t* const data, const int size) {
+  if (kCapacity - size_ < size) return false;
+
+  for (int i{0}; i < size; ++i) {
+    buffer_[(head_ + size_ + i) % kCapacity] = data[i];
+  }
+  size_ += size;
+  return true;
+}
+
+void TransmitBuffer::Flush() {
+  int count{min(stream_.availableForWrite(), size_)};
+  while (count > 0) {
+    const int chunk{min(count, kCapacity - head_)};
+    const int written{static_cast<int>(stream_.write(buffer_ + head_, chunk))};
+
+    head_ = (head_ + written) % kCapacity;
+    size_ -= written;
+    count -= written;
+    // The rest is kept for the next flush if the stream took less than asked
+    if (written < chunk) break;
+  }
+}
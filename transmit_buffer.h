@@ -0,0 +1,53 @@
+#ifndef TETRIS_TRANSMIT_BUFFER_H_
+#define TETRIS_TRANSMIT_BUFFER_H_
+
+#include <Arduino.h>
+
+/**
+ * The TransmitBuffer class queues outgoing bytes and passes them to the
+ * stream only as fast as its own transmit buffer empties, so writing never
+ * blocks. Data is queued as a whole or not at all, which keeps frames from
+ * several senders sharing the stream intact.
+ *
+ * Any stream can be used, e.g. `Serial` on the device or a pty or socketpair
+ * on a host build, as long as it reports its free space with
+ * `availableForWrite`.
+ */
+class TransmitBuffer {
+ public:
+  /**
+   * @param stream The stream to write the bytes to
+   */
+  explicit TransmitBuffer(Stream& stream) : stream_{stream} {}
+
+  /**
+   * Queues the data, if there is enough room for all of it.
+   *
+   * @param data The bytes to send
+   * @param size The number of bytes
+   *
+   * @returns True if the data was queued, false otherwise.
+   */
+  bool Write(const uint8_t* const data, const int size);
+  /**
+   * Writes as many queued bytes to the stream as it accepts without blocking.
+   * Bytes the stream does not take are kept for the next call.
+   */
+  void Flush();
+
+  /**
+   * @returns True if any bytes are still waiting to be sent.
+   */
+  bool Pending() const { return size_ > 0; }
+
+ private:
+  static constexpr int kCapacity{128};
+
+  Stream& stream_;
+
+  uint8_t buffer_[kCapacity];
+  int head_{0};
+  int size_{0};
+};
+
+#endif  // TETRIS_TRANSMIT_BUFFER_H_